@@ -0,0 +1,369 @@
+// Host microbenchmarks for the Seesaw component's CPU hot paths, built against the stub
+// ESPHome headers in bench/stubs and a null I2C bus.
+//
+//   seesaw_bench                         print ns/op and allocations/op for every case
+//   seesaw_bench --baseline FILE         also compare against FILE, exit 1 on an allocation increase
+//   seesaw_bench --check-time            with --baseline, also fail on ns/op slowdowns
+//   seesaw_bench --tolerance 0.5         allowed ns/op slowdown under --check-time (default 50%)
+//   seesaw_bench --write-baseline FILE   record this run as the new baseline
+//
+// Allocation counts are exact and machine independent, so any increase is a regression.
+// Timings depend on the machine the baseline was recorded on; by default slowdowns are only
+// reported, and --check-time turns them into failures for runs on that same machine.
+
+#include "esphome/components/seesaw/binary_sensor.h"
+#include "esphome/components/seesaw/light.h"
+#include "esphome/components/seesaw/seesaw.h"
+#include "null_bus.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::seesaw;
+
+// Allocation counting
+
+static uint64_t g_allocations = 0;
+
+void *operator new(size_t size) {
+  g_allocations++;
+  if (void *p = malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+// Access to the protected hot paths
+
+class BenchDevice : public SeesawDevice {
+ public:
+  using SeesawDevice::notify_binary_sensors_;
+  bool is_poll_pending() const { return gpio_poll_pending_; }
+};
+
+class BenchLight : public SeesawNeoPixelLight {
+ public:
+  using SeesawNeoPixelLight::get_view_internal;
+};
+
+struct Hub {
+  std::unique_ptr<BenchDevice> device;
+  std::vector<std::unique_ptr<SeesawGPIOBinarySensor>> sensors;
+};
+
+static std::unique_ptr<Hub> make_hub(size_t num_sensors) {
+  auto hub = std::make_unique<Hub>();
+  hub->device = std::make_unique<BenchDevice>();
+  hub->device->setup();
+  for (size_t pin = 0; pin < num_sensors; pin++) {
+    auto sensor = std::make_unique<SeesawGPIOBinarySensor>();
+    sensor->set_parent(hub->device.get());
+    sensor->set_pin(pin);
+    sensor->setup();
+    hub->sensors.push_back(std::move(sensor));
+  }
+  return hub;
+}
+
+static std::unique_ptr<BenchLight> make_light(SeesawDevice *parent, uint16_t num_leds) {
+  auto light = std::make_unique<BenchLight>();
+  light->set_parent(parent);
+  light->set_num_leds(num_leds);
+  light->set_color_order(SEESAW_COLOR_ORDER_GRB);
+  light->setup();
+  return light;
+}
+
+// Measurement
+
+struct Result {
+  std::string name;
+  double ns_per_op;
+  double allocs_per_op;
+};
+
+static std::vector<Result> g_results;
+
+// Runs `batch` (which performs `ops` operations) until a batch takes at least 2 ms, then
+// keeps the fastest of several batches to filter out scheduler noise.
+static void measure(const std::string &name, size_t ops, const std::function<void()> &batch) {
+  using clock = std::chrono::steady_clock;
+  const double min_batch_ns = 2e6;
+  const int repeats = 7;
+
+  batch();  // Warm up
+
+  size_t iterations = 1;
+  while (true) {
+    auto start = clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+      batch();
+    }
+    double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    if (ns >= min_batch_ns || iterations >= (1u << 24)) {
+      break;
+    }
+    iterations *= 2;
+  }
+
+  double best_ns = 0;
+  uint64_t allocations = 0;
+  for (int r = 0; r < repeats; r++) {
+    uint64_t allocs_before = g_allocations;
+    auto start = clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+      batch();
+    }
+    double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    allocations = g_allocations - allocs_before;
+    if (r == 0 || ns < best_ns) {
+      best_ns = ns;
+    }
+  }
+
+  double total_ops = (double) iterations * ops;
+  g_results.push_back({name, best_ns / total_ops, allocations / total_ops});
+  printf("%-40s %12.1f ns/op %8.2f allocs/op\n", name.c_str(), best_ns / total_ops, allocations / total_ops);
+}
+
+// Cases
+
+// Up to the longest RGB chain the bench hub (a SAMD09) drives; the light clamps anything longer
+static const uint16_t LED_COUNTS[] = {4, 16, 64, 170};
+static const size_t HUB_COUNTS[] = {1, 2, 4, 8, 16};
+static const size_t SENSOR_COUNTS[] = {1, 8, 32};
+
+// One op: fetch the view of a pixel and store a color through it
+static void bench_get_view() {
+  auto hub = make_hub(0);
+  for (uint16_t leds : LED_COUNTS) {
+    auto light = make_light(hub->device.get(), leds);
+    uint8_t c = 0;
+    measure("get_view/leds=" + std::to_string(leds), leds, [&]() {
+      for (int32_t i = 0; i < leds; i++) {
+        light->get_view_internal(i).set_rgbw(c, c + 1, c + 2, 0);
+      }
+      c++;
+    });
+  }
+}
+
+// One op: chunk, frame and send a whole frame plus the show command
+static void bench_write_state() {
+  auto hub = make_hub(0);
+  for (uint16_t leds : LED_COUNTS) {
+    auto light = make_light(hub->device.get(), leds);
+    measure("write_state/leds=" + std::to_string(leds), 1, [&]() { light->write_state(nullptr); });
+  }
+}
+
+// One op: dispatch a changed GPIO word to every sensor on one hub
+static void bench_notify() {
+  for (size_t hubs : {1, 4, 16}) {
+    for (size_t sensors : SENSOR_COUNTS) {
+      std::vector<std::unique_ptr<Hub>> all;
+      for (size_t h = 0; h < hubs; h++) {
+        all.push_back(make_hub(sensors));
+      }
+      uint32_t word = 0;
+      measure("notify/hubs=" + std::to_string(hubs) + ",sensors=" + std::to_string(sensors), hubs, [&]() {
+        word = ~word;  // Every pin flips, so every sensor publishes
+        for (auto &hub : all) {
+          hub->device->notify_binary_sensors_(word);
+        }
+      });
+    }
+  }
+
+  // The common case at a 20 ms poll: nothing pressed or released since the last read
+  std::vector<std::unique_ptr<Hub>> all;
+  for (size_t h = 0; h < 16; h++) {
+    all.push_back(make_hub(32));
+  }
+  measure("notify_unchanged/hubs=16,sensors=32", all.size(), [&]() {
+    for (auto &hub : all) {
+      hub->device->notify_binary_sensors_(0);
+    }
+  });
+}
+
+// One op: a bulk GPIO read and decode on one hub (settle delay skipped, null bus)
+static void bench_read_gpio_bulk() {
+  for (size_t hubs : HUB_COUNTS) {
+    std::vector<std::unique_ptr<Hub>> all;
+    for (size_t h = 0; h < hubs; h++) {
+      all.push_back(make_hub(1));
+    }
+    uint32_t sink = 0;
+    measure("read_gpio_bulk/hubs=" + std::to_string(hubs), hubs, [&]() {
+      for (auto &hub : all) {
+        uint32_t value;
+        hub->device->read_gpio_bulk(&value);
+        sink ^= value;
+      }
+    });
+    if (sink == 0x12345678) {
+      printf("\n");  // Keep the reads observable
+    }
+  }
+}
+
+// One op: a full poll cycle of every hub on a simulated 400 kHz bus with the real 250us
+// settle delay. "blocking" is each hub doing a blocking read_gpio_bulk() in turn; "split" is
+// every hub's update() landing in the same scheduler pass, then loop() until all have read,
+// so the settle delays overlap.
+static void bench_poll_cycle() {
+  bench::null_bus.byte_time_ns = 22500;  // 9 bit times at 400 kHz
+  bench::null_bus.real_delays = true;
+
+  for (size_t hubs : {1, 4, 16}) {
+    std::vector<std::unique_ptr<Hub>> all;
+    for (size_t h = 0; h < hubs; h++) {
+      all.push_back(make_hub(4));
+    }
+    measure("poll_cycle_blocking/hubs=" + std::to_string(hubs), 1, [&]() {
+      for (auto &hub : all) {
+        uint32_t value;
+        if (hub->device->read_gpio_bulk(&value)) {
+          hub->device->notify_binary_sensors_(value);
+        }
+      }
+    });
+    measure("poll_cycle_split/hubs=" + std::to_string(hubs), 1, [&]() {
+      for (auto &hub : all) {
+        hub->device->update();
+      }
+      bool idle;
+      do {
+        idle = true;
+        for (auto &hub : all) {
+          hub->device->loop();
+          idle = idle && !hub->device->is_poll_pending();
+        }
+      } while (!idle);
+    });
+  }
+
+  bench::null_bus.byte_time_ns = 0;
+  bench::null_bus.real_delays = false;
+}
+
+// Baseline handling
+
+static std::map<std::string, Result> read_baseline(const char *path) {
+  std::map<std::string, Result> baseline;
+  FILE *f = fopen(path, "r");
+  if (f == nullptr) {
+    fprintf(stderr, "Cannot open baseline %s\n", path);
+    exit(2);
+  }
+  char line[256];
+  while (fgets(line, sizeof(line), f) != nullptr) {
+    char name[128];
+    Result r;
+    if (line[0] == '#' || sscanf(line, "%127s %lf %lf", name, &r.ns_per_op, &r.allocs_per_op) != 3) {
+      continue;
+    }
+    r.name = name;
+    baseline[name] = r;
+  }
+  fclose(f);
+  return baseline;
+}
+
+static void write_baseline(const char *path) {
+  FILE *f = fopen(path, "w");
+  if (f == nullptr) {
+    fprintf(stderr, "Cannot write baseline %s\n", path);
+    exit(2);
+  }
+  fprintf(f, "# Seesaw host benchmark baseline: name ns_per_op allocs_per_op\n");
+  fprintf(f, "# Regenerate with: seesaw_bench --write-baseline bench/baseline.txt\n");
+  for (auto &r : g_results) {
+    fprintf(f, "%s %.1f %.2f\n", r.name.c_str(), r.ns_per_op, r.allocs_per_op);
+  }
+  fclose(f);
+}
+
+// Returns the number of regressions
+static int compare(const std::map<std::string, Result> &baseline, bool check_time, double tolerance) {
+  int regressions = 0;
+  if (check_time) {
+    printf("\nComparing against baseline (allocations, ns/op tolerance %.0f%%):\n", tolerance * 100);
+  } else {
+    printf("\nComparing against baseline (allocations only, ns/op informational):\n");
+  }
+  for (auto &r : g_results) {
+    auto it = baseline.find(r.name);
+    if (it == baseline.end()) {
+      printf("  NEW        %s\n", r.name.c_str());
+      continue;
+    }
+    const Result &base = it->second;
+    if (r.allocs_per_op > base.allocs_per_op + 0.005) {
+      printf("  REGRESSED  %-40s allocs/op %.2f -> %.2f\n", r.name.c_str(), base.allocs_per_op, r.allocs_per_op);
+      regressions++;
+    }
+    // Ignore a few nanoseconds of jitter on the cheapest ops
+    if (r.ns_per_op > base.ns_per_op * (1 + tolerance) && r.ns_per_op - base.ns_per_op > 5.0) {
+      printf("  %-10s %-40s ns/op %.1f -> %.1f\n", check_time ? "REGRESSED" : "SLOWER", r.name.c_str(),
+             base.ns_per_op, r.ns_per_op);
+      if (check_time) {
+        regressions++;
+      }
+    }
+  }
+  printf(regressions == 0 ? "  OK\n" : "  %d regression(s)\n", regressions);
+  return regressions;
+}
+
+int main(int argc, char **argv) {
+  const char *baseline_path = nullptr;
+  const char *write_path = nullptr;
+  bool check_time = false;
+  double tolerance = 0.5;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+      baseline_path = argv[++i];
+    } else if (strcmp(argv[i], "--write-baseline") == 0 && i + 1 < argc) {
+      write_path = argv[++i];
+    } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+      tolerance = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--check-time") == 0) {
+      check_time = true;
+    } else {
+      fprintf(stderr, "Usage: %s [--baseline FILE] [--check-time] [--tolerance FRACTION] [--write-baseline FILE]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  bench_get_view();
+  bench_write_state();
+  bench_notify();
+  bench_read_gpio_bulk();
+  bench_poll_cycle();
+
+  if (write_path != nullptr) {
+    write_baseline(write_path);
+  }
+  if (baseline_path != nullptr && compare(read_baseline(baseline_path), check_time, tolerance) != 0) {
+    return 1;
+  }
+  return 0;
+}
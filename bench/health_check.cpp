@@ -0,0 +1,238 @@
+// Host check of the Seesaw hub's fault recovery, built against the same stubs as the
+// benchmarks. Failures are injected through bench::null_bus.fail_next, and the scheduler is
+// driven by hand: update() and loop() are called directly, and the pending probe timeout is
+// run explicitly.
+//
+//   seesaw_health_check   exit 0 if every check passes, 1 otherwise
+
+#include "esphome/components/seesaw/binary_sensor.h"
+#include "esphome/components/seesaw/light.h"
+#include "esphome/components/seesaw/seesaw.h"
+#include "null_bus.h"
+
+#include <cstdio>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+using namespace esphome;
+using namespace esphome::seesaw;
+
+static int g_failures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      g_failures++; \
+    } \
+  } while (0)
+
+// Access to the backoff state and the pending probe
+
+class CheckDevice : public SeesawDevice {
+ public:
+  uint32_t get_probe_interval() const { return probe_interval_ms_; }
+  uint32_t get_pending_timeout_ms() const { return timeout_ ? timeout_ms_ : 0; }
+  bool run_pending_timeout() {
+    if (!timeout_) {
+      return false;
+    }
+    auto f = std::move(timeout_);
+    timeout_ = nullptr;
+    f();
+    return true;
+  }
+};
+
+struct Rig {
+  std::unique_ptr<CheckDevice> device;
+  std::unique_ptr<SeesawGPIOBinarySensor> sensor;
+  std::unique_ptr<SeesawNeoPixelLight> light;
+};
+
+// One NeoKey-style hub: a pull-up button and a NeoPixel chain, set up in priority order
+static Rig make_rig(uint16_t num_leds = 4, SeesawColorOrder color_order = SEESAW_COLOR_ORDER_GRB) {
+  Rig rig;
+  rig.device = std::make_unique<CheckDevice>();
+  rig.device->setup();
+  rig.sensor = std::make_unique<SeesawGPIOBinarySensor>();
+  rig.sensor->set_parent(rig.device.get());
+  rig.sensor->set_pin(NEOKEY_1X4_BUTTON_PIN_0);
+  rig.sensor->setup();
+  rig.light = std::make_unique<SeesawNeoPixelLight>();
+  rig.light->set_parent(rig.device.get());
+  rig.light->set_pin(NEOKEY_1X4_NEOPIXEL_PIN);
+  rig.light->set_num_leds(num_leds);
+  rig.light->set_color_order(color_order);
+  rig.light->setup();
+  return rig;
+}
+
+// One update interval: the poll is started, then collected once the settle delay has passed
+static void poll(CheckDevice *device) {
+  device->update();
+  bench::advance_time_ms(1);
+  device->loop();
+}
+
+// Takes a connected hub offline through failed transactions
+static void force_offline(CheckDevice *device) {
+  bench::null_bus.fail_next = 5;
+  for (int i = 0; i < 5 && device->is_connected(); i++) {
+    device->write_register(SEESAW_STATUS_BASE, SEESAW_STATUS_SWRST);
+  }
+  bench::null_bus.fail_next = 0;
+}
+
+static void start_recording() {
+  bench::null_bus_writes.clear();
+  bench::null_bus.record_writes = true;
+}
+
+// Whether the recorded writes contain `expected` as a subsequence
+static bool wrote_in_order(std::initializer_list<bench::NullBusWrite> expected) {
+  auto it = expected.begin();
+  for (auto &w : bench::null_bus_writes) {
+    if (it != expected.end() && w.module == it->module && w.reg == it->reg) {
+      ++it;
+    }
+  }
+  return it == expected.end();
+}
+
+int main() {
+  // Boot with the board unplugged: no mark_failed, just a probe scheduled at the shortest interval
+  bench::null_bus.fail_next = UINT32_MAX;
+  Rig rig = make_rig();
+  CheckDevice *device = rig.device.get();
+  CHECK(device->get_health() == SEESAW_HEALTH_OFFLINE);
+  CHECK(!device->is_failed());
+  CHECK(!rig.light->is_failed());
+  CHECK(device->get_pending_timeout_ms() == 100);
+
+  // Offline hubs put nothing on the bus
+  uint64_t before = bench::null_bus_transactions;
+  poll(device);
+  CHECK(bench::null_bus_transactions == before);
+
+  // Failed probes double the interval up to the 30 s cap
+  for (uint32_t expected : {200, 400, 800, 1600, 3200, 6400, 12800, 25600, 30000, 30000}) {
+    CHECK(device->run_pending_timeout());
+    CHECK(device->get_health() == SEESAW_HEALTH_OFFLINE);
+    CHECK(device->get_pending_timeout_ms() == expected);
+  }
+
+  // Plugged back in: the probe re-applies the pin config, NeoPixel config and frame
+  bench::null_bus.fail_next = 0;
+  start_recording();
+  CHECK(device->run_pending_timeout());
+  CHECK(device->get_health() == SEESAW_HEALTH_ONLINE);
+  CHECK(wrote_in_order({
+      {SEESAW_STATUS_BASE, SEESAW_STATUS_HW_ID},
+      {SEESAW_GPIO_BASE, SEESAW_GPIO_DIRCLR_BULK},
+      {SEESAW_GPIO_BASE, SEESAW_GPIO_PULLENSET},
+      {SEESAW_GPIO_BASE, SEESAW_GPIO_BULK_SET},
+      {SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_PIN},
+      {SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_SPEED},
+      {SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_BUF_LENGTH},
+      {SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_BUF},
+      {SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_SHOW},
+  }));
+  // The backoff survives a reconnect until the link has proven stable
+  CHECK(device->get_probe_interval() == 30000);
+
+  // One failure degrades the hub; it takes 10 successes in a row to recover
+  bench::null_bus.fail_next = 1;
+  poll(device);
+  CHECK(device->get_health() == SEESAW_HEALTH_DEGRADED);
+  for (int i = 0; i < 4; i++) {
+    poll(device);  // Two successful transactions each
+  }
+  CHECK(device->get_health() == SEESAW_HEALTH_DEGRADED);
+  poll(device);
+  CHECK(device->get_health() == SEESAW_HEALTH_ONLINE);
+
+  // A failure part-way through recovery starts the success count over
+  bench::null_bus.fail_next = 1;
+  poll(device);
+  for (int i = 0; i < 4; i++) {
+    poll(device);
+  }
+  bench::null_bus.fail_next = 1;
+  poll(device);
+  for (int i = 0; i < 4; i++) {
+    poll(device);
+  }
+  CHECK(device->get_health() == SEESAW_HEALTH_DEGRADED);
+  for (int i = 0; i < 5; i++) {
+    poll(device);
+  }
+  CHECK(device->get_health() == SEESAW_HEALTH_ONLINE);
+
+  // A flapping link (every other poll fails) goes offline after 5 failures, not never
+  for (int i = 0; i < 4; i++) {
+    bench::null_bus.fail_next = 1;
+    poll(device);
+    poll(device);
+  }
+  CHECK(device->get_health() == SEESAW_HEALTH_DEGRADED);
+  bench::null_bus.fail_next = 1;
+  poll(device);
+  CHECK(device->get_health() == SEESAW_HEALTH_OFFLINE);
+  CHECK(device->get_pending_timeout_ms() == 30000);
+
+  // Once the hub has stayed online for a minute, the backoff starts over
+  CHECK(device->run_pending_timeout());
+  CHECK(device->get_health() == SEESAW_HEALTH_ONLINE);
+  bench::advance_time_ms(59000);
+  poll(device);
+  CHECK(device->get_probe_interval() == 30000);
+  bench::advance_time_ms(1000);
+  poll(device);
+  CHECK(device->get_probe_interval() == 0);
+  force_offline(device);
+  CHECK(device->get_health() == SEESAW_HEALTH_OFFLINE);
+  CHECK(device->get_pending_timeout_ms() == 100);
+  CHECK(device->run_pending_timeout());
+  CHECK(device->get_health() == SEESAW_HEALTH_ONLINE);
+
+  // A frame that failed part-way is re-sent and latched on the next update
+  bench::null_bus.fail_next = 1;
+  CHECK(!rig.light->write_frame());
+  start_recording();
+  device->update();
+  CHECK(wrote_in_order({{SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_BUF}, {SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_SHOW}}));
+  start_recording();
+  device->update();
+  CHECK(!wrote_in_order({{SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_SHOW}}));
+  bench::advance_time_ms(1);
+  device->loop();
+
+  // A half-connected board reading back 0xFF is a failed probe, never a failed component
+  force_offline(device);
+  bench::null_bus.read_value = 0xFF;
+  CHECK(device->run_pending_timeout());
+  CHECK(device->get_health() == SEESAW_HEALTH_OFFLINE);
+  CHECK(!device->is_failed());
+  bench::null_bus.read_value = SEESAW_HW_ID_CODE_SAMD09;
+  CHECK(device->run_pending_timeout());
+  CHECK(device->get_health() == SEESAW_HEALTH_ONLINE);
+
+  // A chain past the chip's capacity is cut at a whole pixel: 127 RGBW pixels on a SAMD09
+  Rig big = make_rig(130, SEESAW_COLOR_ORDER_GRBW);
+  CHECK(big.light->size() == 127);
+  CHECK(big.device->get_neopixel_buf_len() == 508);
+
+  // Unreachable at boot, the light keeps its full size and the hub clamps once it knows the chip
+  bench::null_bus.fail_next = UINT32_MAX;
+  Rig late = make_rig(130, SEESAW_COLOR_ORDER_GRBW);
+  CHECK(late.light->size() == 130);
+  bench::null_bus.fail_next = 0;
+  CHECK(late.device->run_pending_timeout());
+  CHECK(late.device->get_health() == SEESAW_HEALTH_ONLINE);
+  CHECK(late.device->get_neopixel_buf_len() == 508);
+
+  printf(g_failures == 0 ? "All health checks passed\n" : "%d health check(s) failed\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+namespace esphome {
+namespace binary_sensor {
+
+class BinarySensor {
+ public:
+  virtual ~BinarySensor() = default;
+
+  void publish_state(bool state) {
+    state_ = state;
+    publish_count_++;
+  }
+
+  bool state_{false};
+  unsigned publish_count_{0};
+};
+
+}  // namespace binary_sensor
+}  // namespace esphome
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "null_bus.h"
+
+namespace esphome {
+namespace i2c {
+
+enum ErrorCode {
+  ERROR_OK = 0,
+  ERROR_INVALID_ARGUMENT = 1,
+  ERROR_NOT_ACKNOWLEDGED = 2,
+  ERROR_TIMEOUT = 3,
+};
+
+// Null bus: transactions succeed unless bench::null_bus.fail_next says otherwise, and reads
+// return bench::null_bus.read_value
+class I2CDevice {
+ public:
+  void set_i2c_address(uint8_t address) { address_ = address; }
+
+  ErrorCode write(const uint8_t *data, size_t len) {
+    bench::null_bus_transactions++;
+    bench::spin_ns((uint64_t) (len + 1) * bench::null_bus.byte_time_ns);  // +1 for the address byte
+    if (consume_failure_()) {
+      return ERROR_NOT_ACKNOWLEDGED;
+    }
+    if (bench::null_bus.record_writes && len >= 2) {
+      bench::null_bus_writes.push_back({data[0], data[1]});
+    }
+    return ERROR_OK;
+  }
+
+  ErrorCode read(uint8_t *data, size_t len) {
+    bench::null_bus_transactions++;
+    bench::spin_ns((uint64_t) (len + 1) * bench::null_bus.byte_time_ns);
+    if (consume_failure_()) {
+      return ERROR_NOT_ACKNOWLEDGED;
+    }
+    memset(data, bench::null_bus.read_value, len);
+    return ERROR_OK;
+  }
+
+ protected:
+  static bool consume_failure_() {
+    if (bench::null_bus.fail_next == 0) {
+      return false;
+    }
+    if (bench::null_bus.fail_next != UINT32_MAX) {
+      bench::null_bus.fail_next--;
+    }
+    return true;
+  }
+
+  uint8_t address_{0x30};
+};
+
+}  // namespace i2c
+}  // namespace esphome
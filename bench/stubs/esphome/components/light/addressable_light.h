@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace light {
+
+enum class ColorMode : uint8_t { RGB, RGB_WHITE };
+
+class LightTraits {
+ public:
+  void set_supported_color_modes(std::initializer_list<ColorMode> modes) {}
+};
+
+class ESPColorCorrection {};
+
+class ESPColorView {
+ public:
+  ESPColorView(uint8_t *red, uint8_t *green, uint8_t *blue, uint8_t *white, uint8_t *effect_data,
+               const ESPColorCorrection *color_correction)
+      : red(red), green(green), blue(blue), white(white), effect_data(effect_data) {}
+
+  void set_rgbw(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    *red = r;
+    *green = g;
+    *blue = b;
+    if (white != nullptr)
+      *white = w;
+  }
+
+  uint8_t *const red;
+  uint8_t *const green;
+  uint8_t *const blue;
+  uint8_t *const white;
+  uint8_t *const effect_data;
+};
+
+class LightState;
+
+class AddressableLight : public Component {
+ public:
+  virtual int32_t size() const = 0;
+  virtual LightTraits get_traits() = 0;
+  virtual void write_state(LightState *state) = 0;
+  virtual void clear_effect_data() = 0;
+  ESPColorView operator[](int32_t index) const { return this->get_view_internal(index); }
+
+ protected:
+  virtual ESPColorView get_view_internal(int32_t index) const = 0;
+
+  ESPColorCorrection correction_{};
+};
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace esphome {
+
+namespace setup_priority {
+constexpr float DATA = 600.0f;
+}  // namespace setup_priority
+
+// Runs setup()/loop() by hand; set_timeout() only records the pending callback and its delay
+class Component {
+ public:
+  virtual ~Component() = default;
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual float get_setup_priority() const { return 0.0f; }
+
+  void mark_failed() { failed_ = true; }
+  bool is_failed() const { return failed_; }
+  void status_set_warning() {}
+  void status_clear_warning() {}
+
+ protected:
+  void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {
+    timeout_ = std::move(f);
+    timeout_ms_ = timeout;
+  }
+
+  bool failed_{false};
+  std::function<void()> timeout_;
+  uint32_t timeout_ms_{0};
+};
+
+class PollingComponent : public Component {
+ public:
+  virtual void update() = 0;
+};
+
+}  // namespace esphome
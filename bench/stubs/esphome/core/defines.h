@@ -0,0 +1,4 @@
+#pragma once
+
+// The benchmarks model the ESP32 target (128-byte host I2C buffer)
+#define USE_ESP32
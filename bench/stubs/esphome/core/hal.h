@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+
+uint32_t micros();
+uint32_t millis();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+}  // namespace esphome
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+namespace esphome {
+
+constexpr uint32_t encode_uint32(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4) {
+  return (uint32_t(byte1) << 24) | (uint32_t(byte2) << 16) | (uint32_t(byte3) << 8) | uint32_t(byte4);
+}
+
+class HighFrequencyLoopRequester {
+ public:
+  void start() { started_ = true; }
+  void stop() { started_ = false; }
+
+ protected:
+  bool started_{false};
+};
+
+template<class T> class ExternalRAMAllocator {
+ public:
+  enum Flags { NONE = 0, REFUSE_INTERNAL = 1 << 0, ALLOW_FAILURE = 1 << 2 };
+
+  ExternalRAMAllocator() = default;
+  ExternalRAMAllocator(Flags flags) {}
+
+  T *allocate(size_t n) { return static_cast<T *>(malloc(n * sizeof(T))); }
+  void deallocate(T *p, size_t n) { free(p); }
+};
+
+}  // namespace esphome
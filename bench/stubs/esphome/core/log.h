@@ -0,0 +1,12 @@
+#pragma once
+
+// Logging compiles away so the benchmarks measure the component, not the logger
+#define ESP_LOGE(tag, ...) ((void) (tag))
+#define ESP_LOGW(tag, ...) ((void) (tag))
+#define ESP_LOGI(tag, ...) ((void) (tag))
+#define ESP_LOGD(tag, ...) ((void) (tag))
+#define ESP_LOGV(tag, ...) ((void) (tag))
+#define ESP_LOGCONFIG(tag, ...) ((void) (tag))
+#define LOG_I2C_DEVICE(this)
+#define LOG_UPDATE_INTERVAL(this)
+#define LOG_BINARY_SENSOR(prefix, type, obj)
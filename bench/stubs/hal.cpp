@@ -0,0 +1,49 @@
+#include "esphome/core/hal.h"
+#include "null_bus.h"
+
+#include <chrono>
+
+namespace bench {
+
+NullBusConfig null_bus;
+uint64_t null_bus_transactions = 0;
+std::vector<NullBusWrite> null_bus_writes;
+static uint64_t time_offset_us = 0;
+
+void spin_ns(uint64_t ns) {
+  if (ns == 0) {
+    return;
+  }
+  auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(ns);
+  while (std::chrono::steady_clock::now() < until) {
+  }
+}
+
+void advance_time_ms(uint32_t ms) { time_offset_us += (uint64_t) ms * 1000; }
+
+static uint64_t now_us() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+             .count() +
+         time_offset_us;
+}
+
+}  // namespace bench
+
+namespace esphome {
+
+static const uint64_t START_US = bench::now_us();
+
+uint32_t micros() { return (uint32_t) (bench::now_us() - START_US); }
+
+uint32_t millis() { return (uint32_t) ((bench::now_us() - START_US) / 1000); }
+
+// Reset/boot delays in setup() are never worth simulating
+void delay(uint32_t ms) {}
+
+void delayMicroseconds(uint32_t us) {
+  if (bench::null_bus.real_delays) {
+    bench::spin_ns((uint64_t) us * 1000);
+  }
+}
+
+}  // namespace esphome
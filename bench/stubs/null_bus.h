@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Knobs for the stub I2C bus and HAL used by the host benchmarks and health check.
+namespace bench {
+
+struct NullBusConfig {
+  // Byte returned for every read (0x55 is the SAMD09 hardware ID)
+  uint8_t read_value{0x55};
+  // Simulated wire time per transferred byte; 0 makes the bus free
+  uint32_t byte_time_ns{0};
+  // Whether delayMicroseconds() really waits (otherwise the Seesaw settle delay is skipped)
+  bool real_delays{false};
+  // Number of upcoming transactions (reads or writes) to NAK; UINT32_MAX unplugs the board
+  uint32_t fail_next{0};
+  // Whether successful writes are appended to null_bus_writes
+  bool record_writes{false};
+};
+
+// Module and function register of a successful write, as sent on the wire
+struct NullBusWrite {
+  uint8_t module;
+  uint8_t reg;
+};
+
+extern NullBusConfig null_bus;
+extern uint64_t null_bus_transactions;
+extern std::vector<NullBusWrite> null_bus_writes;
+
+// Busy-waits without yielding, like the I2C drivers and delayMicroseconds() on target
+void spin_ns(uint64_t ns);
+
+// Moves millis()/micros() forward without waiting, for backoff and settle delay timing
+void advance_time_ms(uint32_t ms);
+
+}  // namespace bench
@@ -9,29 +9,26 @@ static const char *const TAG = "seesaw.binary_sensor";
 void SeesawGPIOBinarySensor::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Seesaw GPIO Binary Sensor on pin %d...", pin_);
 
-  // Configure the GPIO pin
+  // Register with parent for updates
+  parent_->register_binary_sensor(this);
+
+  // Configure the GPIO pin. The hub remembers the mode and re-applies it if the board
+  // isn't responding yet or comes back after an outage.
   uint32_t pin_mask = get_pin_mask();
 
   switch (pin_mode_) {
     case SEESAW_PIN_MODE_INPUT:
       if (!parent_->set_gpio_input(pin_mask)) {
-        ESP_LOGE(TAG, "Failed to configure pin %d as input", pin_);
-        this->mark_failed();
-        return;
+        ESP_LOGW(TAG, "Pin %d input config deferred until the Seesaw responds", pin_);
       }
       break;
     case SEESAW_PIN_MODE_INPUT_PULLUP:
       if (!parent_->set_gpio_input_pullup(pin_mask)) {
-        ESP_LOGE(TAG, "Failed to configure pin %d as input with pull-up", pin_);
-        this->mark_failed();
-        return;
+        ESP_LOGW(TAG, "Pin %d pull-up config deferred until the Seesaw responds", pin_);
       }
       break;
   }
 
-  // Register with parent for updates
-  parent_->register_binary_sensor(this);
-
   ESP_LOGCONFIG(TAG, "Seesaw GPIO Binary Sensor on pin %d configured", pin_);
 }
 
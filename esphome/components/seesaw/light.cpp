@@ -10,14 +10,21 @@ namespace seesaw {
 
 static const char *const TAG = "seesaw.light";
 
-// Maximum bytes to send in one I2C transaction (Seesaw limit)
-static const size_t SEESAW_NEOPIXEL_MAX_CHUNK = 30;
-
 void SeesawNeoPixelLight::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Seesaw NeoPixel Light...");
 
   uint8_t bpp = bytes_per_pixel_();
-  size_t buffer_size = num_leds_ * bpp;
+
+  // If the hub already knows its chip, don't allocate or expose LEDs it can't drive. A hub
+  // that hasn't answered yet can't tell, and the light can't be resized once effects and
+  // the light state hold its size, so the full chain is kept and the hub clamps what it sends.
+  uint16_t max_pixels = parent_->get_neopixel_max_pixels(bpp);
+  if (max_pixels != 0 && num_leds_ > max_pixels) {
+    ESP_LOGE(TAG, "%d LEDs exceed the Seesaw chip's capacity, limiting to %d", num_leds_, max_pixels);
+    num_leds_ = max_pixels;
+  }
+
+  size_t buffer_size = (size_t) num_leds_ * bpp;
 
   // Allocate buffers using ESPHome's allocator
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
@@ -39,16 +46,14 @@ void SeesawNeoPixelLight::setup() {
   memset(this->buf_, 0, buffer_size);
   memset(this->effect_data_, 0, num_leds_);
 
-  // Initialize NeoPixel on Seesaw
+  // Register with parent so it can restore the frame after a reconnect
+  parent_->register_neopixel_light(this);
+
+  // Initialize NeoPixel on Seesaw; the hub re-applies this once it responds
   if (!parent_->init_neopixel(pin_, num_leds_, bpp)) {
-    ESP_LOGE(TAG, "Failed to initialize NeoPixel on Seesaw");
-    this->mark_failed();
-    return;
+    ESP_LOGW(TAG, "Seesaw not responding, NeoPixel setup deferred until it reconnects");
   }
 
-  // Register with parent
-  parent_->register_neopixel_light(this);
-
   ESP_LOGCONFIG(TAG, "Seesaw NeoPixel Light initialized: %d LEDs, %d bytes/pixel", num_leds_, bpp);
 }
 
@@ -112,53 +117,70 @@ void SeesawNeoPixelLight::get_color_offsets_(uint8_t *r_offset, uint8_t *g_offse
 }
 
 light::ESPColorView SeesawNeoPixelLight::get_view_internal(int32_t index) const {
-  uint8_t bpp = bytes_per_pixel_();
-  uint8_t r_off, g_off, b_off, w_off;
-  get_color_offsets_(&r_off, &g_off, &b_off, &w_off);
-
   // Safety check - return dummy view if buffers not allocated yet
   if (this->buf_ == nullptr) {
     static uint8_t dummy_buf[4] = {0, 0, 0, 0};
     static uint8_t dummy_effect = 0;
-    return light::ESPColorView(&dummy_buf[r_off], &dummy_buf[g_off], &dummy_buf[b_off], nullptr,
+    return light::ESPColorView(&dummy_buf[r_off_], &dummy_buf[g_off_], &dummy_buf[b_off_], nullptr,
                                &dummy_effect, &this->correction_);
   }
 
-  uint8_t *base = this->buf_ + (index * bpp);
+  uint8_t *base = this->buf_ + (index * bytes_per_pixel_());
 
   if (is_rgbw_()) {
-    return light::ESPColorView(base + r_off, base + g_off, base + b_off, base + w_off,
+    return light::ESPColorView(base + r_off_, base + g_off_, base + b_off_, base + w_off_,
                                this->effect_data_ + index, &this->correction_);
   } else {
-    return light::ESPColorView(base + r_off, base + g_off, base + b_off, nullptr,
+    return light::ESPColorView(base + r_off_, base + g_off_, base + b_off_, nullptr,
                                this->effect_data_ + index, &this->correction_);
   }
 }
 
 void SeesawNeoPixelLight::write_state(light::LightState *state) {
-  if (this->is_failed() || this->buf_ == nullptr) {
+  if (this->is_failed()) {
     return;
   }
 
-  uint8_t bpp = bytes_per_pixel_();
-  size_t buffer_size = num_leds_ * bpp;
+  // While the hub is offline the frame just stays in buf_ until it reconnects
+  if (!parent_->is_connected()) {
+    return;
+  }
+
+  this->write_frame();
+}
+
+bool SeesawNeoPixelLight::write_frame() {
+  if (this->buf_ == nullptr) {
+    return false;
+  }
+
+  // Only what fits in the chip's buffer; the hub logs if the chain was clamped
+  size_t buffer_size = std::min((size_t) num_leds_ * bytes_per_pixel_(), (size_t) parent_->get_neopixel_buf_len());
+  // Largest chunk both the chip and the host I2C driver accept, to keep transactions few
+  size_t max_chunk = parent_->get_neopixel_max_chunk();
 
   // Send buffer to Seesaw in chunks
   size_t offset = 0;
   while (offset < buffer_size) {
-    size_t chunk_size = std::min(SEESAW_NEOPIXEL_MAX_CHUNK, buffer_size - offset);
+    size_t chunk_size = std::min(max_chunk, buffer_size - offset);
 
     if (!parent_->write_neopixel_buffer(offset, this->buf_ + offset, chunk_size)) {
-      ESP_LOGW(TAG, "Failed to write NeoPixel buffer at offset %d", offset);
-      return;
+      // The hub tracks link health and logs the outage
+      ESP_LOGV(TAG, "Failed to write NeoPixel buffer at offset %u", (unsigned) offset);
+      parent_->set_frame_dirty(true);
+      return false;
     }
     offset += chunk_size;
   }
 
   // Trigger LED update
   if (!parent_->show_neopixels()) {
-    ESP_LOGW(TAG, "Failed to show NeoPixels");
+    ESP_LOGV(TAG, "Failed to show NeoPixels");
+    parent_->set_frame_dirty(true);
+    return false;
   }
+  parent_->set_frame_dirty(false);
+  return true;
 }
 
 }  // namespace seesaw
@@ -29,10 +29,17 @@ class SeesawNeoPixelLight : public light::AddressableLight {
   float get_setup_priority() const override;
   void write_state(light::LightState *state) override;
 
+  // Sends the whole buffer and latches it; also used by the hub to restore the frame after a reconnect
+  bool write_frame();
+
   void set_parent(SeesawDevice *parent) { parent_ = parent; }
   void set_num_leds(uint16_t num_leds) { num_leds_ = num_leds; }
   void set_pin(uint8_t pin) { pin_ = pin; }
-  void set_color_order(SeesawColorOrder order) { color_order_ = order; }
+  void set_color_order(SeesawColorOrder order) {
+    color_order_ = order;
+    // Resolved once here rather than on every get_view_internal() call
+    get_color_offsets_(&r_off_, &g_off_, &b_off_, &w_off_);
+  }
 
   int32_t size() const override { return num_leds_; }
 
@@ -65,6 +72,10 @@ class SeesawNeoPixelLight : public light::AddressableLight {
   uint16_t num_leds_{0};
   uint8_t pin_{3};  // Default for NeoKey 1x4
   SeesawColorOrder color_order_{SEESAW_COLOR_ORDER_GRB};  // Default for NeoKey 1x4
+  uint8_t r_off_{1};
+  uint8_t g_off_{0};
+  uint8_t b_off_{2};
+  uint8_t w_off_{3};
 
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
@@ -29,13 +29,34 @@ COLOR_ORDERS = {
     "BGRW": SeesawColorOrder.SEESAW_COLOR_ORDER_BGRW,
 }
 
-CONFIG_SCHEMA = light.ADDRESSABLE_LIGHT_SCHEMA.extend({
-    cv.GenerateID(CONF_OUTPUT_ID): cv.declare_id(SeesawNeoPixelLight),
-    cv.GenerateID(CONF_SEESAW_ID): cv.use_id(SeesawDevice),
-    cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
-    cv.Optional(CONF_PIN, default=3): cv.int_range(min=0, max=31),
-    cv.Optional(CONF_COLOR_ORDER, default="GRB"): cv.enum(COLOR_ORDERS, upper=True),
-})
+# Largest NeoPixel buffer of any supported chip (ATtiny1616/1617). Smaller chips are
+# clamped at runtime once the hub has reported its hardware ID.
+MAX_NEOPIXEL_BUF_BYTES = 750
+
+
+def _validate_buffer_size(config):
+    bytes_per_pixel = 4 if config[CONF_COLOR_ORDER].endswith("W") else 3
+    buf_len = config[CONF_NUM_LEDS] * bytes_per_pixel
+    if buf_len > MAX_NEOPIXEL_BUF_BYTES:
+        raise cv.Invalid(
+            f"{config[CONF_NUM_LEDS]} LEDs need {buf_len} bytes, but no Seesaw chip has a "
+            f"NeoPixel buffer larger than {MAX_NEOPIXEL_BUF_BYTES} bytes "
+            f"(at most {MAX_NEOPIXEL_BUF_BYTES // bytes_per_pixel} LEDs)",
+            path=[CONF_NUM_LEDS],
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    light.ADDRESSABLE_LIGHT_SCHEMA.extend({
+        cv.GenerateID(CONF_OUTPUT_ID): cv.declare_id(SeesawNeoPixelLight),
+        cv.GenerateID(CONF_SEESAW_ID): cv.use_id(SeesawDevice),
+        cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
+        cv.Optional(CONF_PIN, default=3): cv.int_range(min=0, max=31),
+        cv.Optional(CONF_COLOR_ORDER, default="GRB"): cv.enum(COLOR_ORDERS, upper=True),
+    }),
+    _validate_buffer_size,
+)
 
 
 async def to_code(config):
@@ -1,13 +1,44 @@
 #include "seesaw.h"
 #include "binary_sensor.h"
+#include "light.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace esphome {
 namespace seesaw {
 
 static const char *const TAG = "seesaw";
 
+// Failed transactions within one degraded episode before the hub is taken offline
+static const uint8_t SEESAW_OFFLINE_FAILURE_THRESHOLD = 5;
+// Consecutive successful transactions before a degraded hub counts as online again
+static const uint8_t SEESAW_RECOVERY_SUCCESS_THRESHOLD = 10;
+// Reconnection probe backoff, kept across reconnects until the hub has stayed online this long
+static const uint32_t SEESAW_PROBE_INTERVAL_MIN_MS = 100;
+static const uint32_t SEESAW_PROBE_INTERVAL_MAX_MS = 30000;
+static const uint32_t SEESAW_STABLE_ONLINE_MS = 60000;
+// Health transitions log at most this often; the rest drop to verbose
+static const uint32_t SEESAW_HEALTH_LOG_INTERVAL_MS = 10000;
+
+// Only referenced from log calls, which may compile out
+[[maybe_unused]] static const char *health_to_str(SeesawHealth health) {
+  switch (health) {
+    case SEESAW_HEALTH_ONLINE:
+      return "ONLINE";
+    case SEESAW_HEALTH_DEGRADED:
+      return "DEGRADED";
+    case SEESAW_HEALTH_OFFLINE:
+      return "OFFLINE";
+    case SEESAW_HEALTH_PROBING:
+      return "PROBING";
+    default:
+      return "UNKNOWN";
+  }
+}
+
 void SeesawDevice::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Seesaw device...");
 
@@ -18,32 +49,75 @@ void SeesawDevice::setup() {
     delay(10);  // Wait for reset to complete
   }
 
-  // Verify hardware ID
-  if (!verify_hardware_id_()) {
-    ESP_LOGE(TAG, "Failed to verify Seesaw hardware ID");
-    this->mark_failed();
+  // Read hardware ID. A board that doesn't answer may just be unplugged, so keep probing it
+  // in the background; children record their config and it is applied once the board is back.
+  uint8_t hw_id;
+  if (!read_register(SEESAW_STATUS_BASE, SEESAW_STATUS_HW_ID, &hw_id, 1)) {
+    ESP_LOGW(TAG, "Seesaw not responding, will keep probing");
+    go_offline_();
     return;
   }
 
-  // Configure GPIO pins for registered binary sensors
-  configure_gpio_pins_();
+  // A wrong chip at this address is a configuration error, not a transient fault
+  if (!is_known_hardware_id_(hw_id)) {
+    ESP_LOGE(TAG, "Unknown Seesaw HW ID: 0x%02X", hw_id);
+    this->mark_failed();
+    return;
+  }
 
+  hardware_id_ = hw_id;
+  health_ = SEESAW_HEALTH_ONLINE;
+  online_since_ms_ = millis();
   ESP_LOGCONFIG(TAG, "Seesaw device initialized (HW ID: 0x%02X)", hardware_id_);
 }
 
 void SeesawDevice::update() {
+  // Offline hubs cost nothing until the next probe
+  if (!is_connected()) {
+    return;
+  }
+
+  // A link that has held up long enough starts over at the shortest probe interval
+  if (probe_interval_ms_ != 0 && health_ == SEESAW_HEALTH_ONLINE &&
+      millis() - online_since_ms_ >= SEESAW_STABLE_ONLINE_MS) {
+    probe_interval_ms_ = 0;
+  }
+
+  // Config that didn't make it to the board during setup
+  if (config_dirty_ && !apply_config_()) {
+    return;
+  }
+
+  // A frame that failed part-way sits half-written and unlatched on the chip
+  if (frame_dirty_ && neopixel_light_ != nullptr && !neopixel_light_->write_frame()) {
+    return;
+  }
+
   if (binary_sensors_.empty()) {
     return;
   }
 
-  uint32_t gpio_state;
-  if (read_gpio_bulk(&gpio_state)) {
-    notify_binary_sensors_(gpio_state);
-  } else {
-    ESP_LOGW(TAG, "Failed to read GPIO state");
+  // Still waiting on the previous poll
+  if (gpio_poll_pending_) {
+    return;
+  }
+
+  // loop() collects the result once the read delay has passed
+  if (start_gpio_poll_()) {
+    high_freq_.start();
   }
 }
 
+void SeesawDevice::loop() {
+  if (gpio_poll_pending_) {
+    if (!is_gpio_poll_ready_()) {
+      return;
+    }
+    finish_gpio_poll_();
+  }
+  high_freq_.stop();
+}
+
 void SeesawDevice::dump_config() {
   ESP_LOGCONFIG(TAG, "Seesaw:");
   LOG_I2C_DEVICE(this);
@@ -51,21 +125,17 @@ void SeesawDevice::dump_config() {
     ESP_LOGE(TAG, "Communication failed");
   }
   ESP_LOGCONFIG(TAG, "  Hardware ID: 0x%02X", hardware_id_);
+  ESP_LOGCONFIG(TAG, "  Health: %s", health_to_str(health_));
+  if (neopixel_requested_len_ != 0 && hardware_id_ != 0) {
+    ESP_LOGCONFIG(TAG, "  NeoPixel buffer: %u of %u bytes, %u bytes per write", neopixel_buf_len_,
+                  get_neopixel_buf_max_(), (unsigned) get_neopixel_max_chunk());
+  }
   LOG_UPDATE_INTERVAL(this);
 }
 
 float SeesawDevice::get_setup_priority() const { return setup_priority::DATA; }
 
-bool SeesawDevice::verify_hardware_id_() {
-  uint8_t hw_id;
-  if (!read_register(SEESAW_STATUS_BASE, SEESAW_STATUS_HW_ID, &hw_id, 1)) {
-    ESP_LOGE(TAG, "Failed to read hardware ID");
-    return false;
-  }
-
-  hardware_id_ = hw_id;
-
-  // Check for known hardware IDs
+bool SeesawDevice::is_known_hardware_id_(uint8_t hw_id) {
   switch (hw_id) {
     case SEESAW_HW_ID_CODE_SAMD09:
     case SEESAW_HW_ID_CODE_TINY806:
@@ -74,28 +144,158 @@ bool SeesawDevice::verify_hardware_id_() {
     case SEESAW_HW_ID_CODE_TINY817:
     case SEESAW_HW_ID_CODE_TINY1616:
     case SEESAW_HW_ID_CODE_TINY1617:
-      ESP_LOGD(TAG, "Found valid Seesaw HW ID: 0x%02X", hw_id);
       return true;
     default:
-      ESP_LOGE(TAG, "Unknown Seesaw HW ID: 0x%02X", hw_id);
       return false;
   }
 }
 
-void SeesawDevice::configure_gpio_pins_() {
-  if (binary_sensors_.empty()) {
+bool SeesawDevice::configure_gpio_pins_() {
+  if (input_mask_ != 0 && !write_gpio_input_(input_mask_)) {
+    return false;
+  }
+  if (pullup_mask_ != 0 && !write_gpio_input_pullup_(pullup_mask_)) {
+    return false;
+  }
+  return true;
+}
+
+bool SeesawDevice::apply_config_() {
+  if (!configure_gpio_pins_()) {
+    return false;
+  }
+  if (neopixel_requested_len_ != 0 && !write_neopixel_config_()) {
+    return false;
+  }
+  if (neopixel_light_ != nullptr && !neopixel_light_->write_frame()) {
+    return false;
+  }
+
+  config_dirty_ = false;
+  // Force a full dispatch so sensors catch up on anything missed while offline
+  gpio_state_valid_ = false;
+  return true;
+}
+
+// Health tracking
+
+void SeesawDevice::record_transaction_(bool ok) {
+  // Probing handles its own transitions; offline hubs don't reach the bus
+  if (!is_connected()) {
     return;
   }
 
-  // Build pin mask from all registered binary sensors
-  uint32_t pin_mask = 0;
-  for (auto *sensor : binary_sensors_) {
-    // Get pin from sensor - we'll need to add a getter
-    // For now we'll configure in the binary sensor setup
+  if (ok) {
+    // A single success doesn't end a degraded episode, or a flapping link would never go offline
+    if (health_ == SEESAW_HEALTH_DEGRADED && ++consecutive_successes_ >= SEESAW_RECOVERY_SUCCESS_THRESHOLD) {
+      if (should_log_health_()) {
+        ESP_LOGI(TAG, "Communication with Seesaw at 0x%02X recovered", this->address_);
+      } else {
+        ESP_LOGV(TAG, "Communication with Seesaw at 0x%02X recovered", this->address_);
+      }
+      health_ = SEESAW_HEALTH_ONLINE;
+      online_since_ms_ = millis();
+      failure_count_ = 0;
+      this->status_clear_warning();
+    }
+    return;
+  }
+
+  consecutive_successes_ = 0;
+  failure_count_++;
+  if (health_ == SEESAW_HEALTH_ONLINE) {
+    // Logged once per episode rather than per failed transaction
+    if (should_log_health_()) {
+      ESP_LOGW(TAG, "Communication with Seesaw at 0x%02X failing", this->address_);
+    } else {
+      ESP_LOGV(TAG, "Communication with Seesaw at 0x%02X failing", this->address_);
+    }
+    health_ = SEESAW_HEALTH_DEGRADED;
+    this->status_set_warning();
+  }
+  if (failure_count_ >= SEESAW_OFFLINE_FAILURE_THRESHOLD) {
+    if (should_log_health_()) {
+      ESP_LOGW(TAG, "Seesaw at 0x%02X offline after %u failed transactions, probing with backoff", this->address_,
+               failure_count_);
+    } else {
+      ESP_LOGV(TAG, "Seesaw at 0x%02X offline after %u failed transactions", this->address_, failure_count_);
+    }
+    go_offline_();
+  }
+}
+
+bool SeesawDevice::should_log_health_() {
+  uint32_t now = millis();
+  if (health_logged_ && now - last_health_log_ms_ < SEESAW_HEALTH_LOG_INTERVAL_MS) {
+    return false;
   }
+  health_logged_ = true;
+  last_health_log_ms_ = now;
+  return true;
+}
+
+void SeesawDevice::go_offline_() {
+  health_ = SEESAW_HEALTH_OFFLINE;
+  gpio_poll_pending_ = false;
+  failure_count_ = 0;
+  consecutive_successes_ = 0;
+  this->status_set_warning();
+
+  // Not reset by a successful probe, so a hub that keeps dropping out backs off further
+  if (probe_interval_ms_ == 0) {
+    probe_interval_ms_ = SEESAW_PROBE_INTERVAL_MIN_MS;
+  } else {
+    probe_interval_ms_ = std::min(probe_interval_ms_ * 2, SEESAW_PROBE_INTERVAL_MAX_MS);
+  }
+  this->set_timeout("probe", probe_interval_ms_, [this]() { this->probe_(); });
+}
+
+void SeesawDevice::probe_() {
+  health_ = SEESAW_HEALTH_PROBING;
+
+  uint8_t hw_id;
+  if (!read_register(SEESAW_STATUS_BASE, SEESAW_STATUS_HW_ID, &hw_id, 1)) {
+    ESP_LOGV(TAG, "Probe of Seesaw at 0x%02X got no answer", this->address_);
+    go_offline_();
+    return;
+  }
+
+  // A board that is half-connected or still booting can read back 0x00 or 0xFF, so anything
+  // but the ID verified at setup (or, if setup never heard from it, a known ID) is just a
+  // failed probe. Only setup() marks a hub failed for its ID.
+  bool expected = hardware_id_ != 0 ? hw_id == hardware_id_ : is_known_hardware_id_(hw_id);
+  if (!expected) {
+    ESP_LOGV(TAG, "Probe of Seesaw at 0x%02X read unexpected HW ID 0x%02X", this->address_, hw_id);
+    go_offline_();
+    return;
+  }
+  hardware_id_ = hw_id;
+
+  // The board may have been power cycled, so restore everything it should be doing
+  if (!apply_config_()) {
+    ESP_LOGV(TAG, "Probe answered but config could not be applied");
+    go_offline_();
+    return;
+  }
+
+  if (should_log_health_()) {
+    ESP_LOGI(TAG, "Seesaw at 0x%02X back online (HW ID: 0x%02X)", this->address_, hardware_id_);
+  } else {
+    ESP_LOGV(TAG, "Seesaw at 0x%02X back online (HW ID: 0x%02X)", this->address_, hardware_id_);
+  }
+  health_ = SEESAW_HEALTH_ONLINE;
+  online_since_ms_ = millis();
+  this->status_clear_warning();
 }
 
 void SeesawDevice::notify_binary_sensors_(uint32_t gpio_state) {
+  // Sensors only publish on change, so an unchanged bulk read needs no dispatch
+  if (gpio_state_valid_ && gpio_state == last_gpio_state_) {
+    return;
+  }
+  last_gpio_state_ = gpio_state;
+  gpio_state_valid_ = true;
+
   for (auto *sensor : binary_sensors_) {
     sensor->process_gpio_state(gpio_state);
   }
@@ -104,18 +304,33 @@ void SeesawDevice::notify_binary_sensors_(uint32_t gpio_state) {
 // Core I2C methods
 
 bool SeesawDevice::write_register(uint8_t module, uint8_t reg, const uint8_t *data, size_t len) {
+  if (len > SEESAW_MAX_WRITE_LEN) {
+    ESP_LOGE(TAG, "I2C write too long: module=0x%02X reg=0x%02X len=%u", module, reg, (unsigned) len);
+    return false;
+  }
+
   // Seesaw uses two-byte addressing: [module_base, function_register]
-  std::vector<uint8_t> buffer;
-  buffer.reserve(2 + len);
-  buffer.push_back(module);
-  buffer.push_back(reg);
+  uint8_t buffer[2 + SEESAW_MAX_WRITE_LEN];
+  buffer[0] = module;
+  buffer[1] = reg;
   if (data != nullptr && len > 0) {
-    buffer.insert(buffer.end(), data, data + len);
+    memcpy(buffer + 2, data, len);
+  }
+
+  return write_frame_(buffer, 2 + len);
+}
+
+bool SeesawDevice::write_frame_(const uint8_t *frame, size_t len) {
+  if (health_ == SEESAW_HEALTH_OFFLINE) {
+    return false;
   }
+  flush_gpio_poll_();
 
-  auto result = this->write(buffer.data(), buffer.size());
+  auto result = this->write(frame, len);
+  record_transaction_(result == i2c::ERROR_OK);
   if (result != i2c::ERROR_OK) {
-    ESP_LOGE(TAG, "I2C write failed: module=0x%02X reg=0x%02X error=%d", module, reg, result);
+    // Per-transaction detail only; health transitions do the user-facing logging
+    ESP_LOGV(TAG, "I2C write failed: module=0x%02X reg=0x%02X error=%d", frame[0], frame[1], result);
     return false;
   }
   return true;
@@ -126,11 +341,17 @@ bool SeesawDevice::write_register(uint8_t module, uint8_t reg) {
 }
 
 bool SeesawDevice::read_register(uint8_t module, uint8_t reg, uint8_t *data, size_t len) {
+  if (health_ == SEESAW_HEALTH_OFFLINE) {
+    return false;
+  }
+  flush_gpio_poll_();
+
   // Write the address first
   uint8_t addr[2] = {module, reg};
   auto write_result = this->write(addr, 2);
   if (write_result != i2c::ERROR_OK) {
-    ESP_LOGE(TAG, "I2C address write failed: module=0x%02X reg=0x%02X error=%d", module, reg, write_result);
+    record_transaction_(false);
+    ESP_LOGV(TAG, "I2C address write failed: module=0x%02X reg=0x%02X error=%d", module, reg, write_result);
     return false;
   }
 
@@ -139,8 +360,9 @@ bool SeesawDevice::read_register(uint8_t module, uint8_t reg, uint8_t *data, siz
 
   // Now read the data
   auto read_result = this->read(data, len);
+  record_transaction_(read_result == i2c::ERROR_OK);
   if (read_result != i2c::ERROR_OK) {
-    ESP_LOGE(TAG, "I2C read failed: module=0x%02X reg=0x%02X error=%d", module, reg, read_result);
+    ESP_LOGV(TAG, "I2C read failed: module=0x%02X reg=0x%02X error=%d", module, reg, read_result);
     return false;
   }
 
@@ -156,12 +378,84 @@ bool SeesawDevice::read_gpio_bulk(uint32_t *value) {
   }
 
   // Big-endian 32-bit value
-  *value = ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) |
-           ((uint32_t)buf[2] << 8) | buf[3];
+  *value = encode_uint32(buf[0], buf[1], buf[2], buf[3]);
+  return true;
+}
+
+bool SeesawDevice::start_gpio_poll_() {
+  if (!is_connected()) {
+    return false;
+  }
+
+  // Address phase only; the data is fetched by finish_gpio_poll_() after SEESAW_DELAY_US
+  uint8_t addr[2] = {SEESAW_GPIO_BASE, SEESAW_GPIO_BULK};
+  auto result = this->write(addr, 2);
+  record_transaction_(result == i2c::ERROR_OK);
+  if (result != i2c::ERROR_OK) {
+    ESP_LOGV(TAG, "Failed to start GPIO read: error=%d", result);
+    return false;
+  }
+
+  gpio_poll_pending_ = true;
+  gpio_poll_started_us_ = micros();
   return true;
 }
 
+bool SeesawDevice::is_gpio_poll_ready_() const {
+  return !gpio_poll_pending_ || (micros() - gpio_poll_started_us_) >= SEESAW_DELAY_US;
+}
+
+void SeesawDevice::finish_gpio_poll_() {
+  // Already completed if another transaction flushed it
+  if (!gpio_poll_pending_) {
+    return;
+  }
+  gpio_poll_pending_ = false;
+
+  uint8_t buf[4];
+  auto result = this->read(buf, 4);
+  record_transaction_(result == i2c::ERROR_OK);
+  if (result != i2c::ERROR_OK) {
+    ESP_LOGV(TAG, "Failed to read GPIO state: error=%d", result);
+    return;
+  }
+
+  notify_binary_sensors_(encode_uint32(buf[0], buf[1], buf[2], buf[3]));
+}
+
+void SeesawDevice::flush_gpio_poll_() {
+  if (!gpio_poll_pending_) {
+    return;
+  }
+
+  uint32_t elapsed = micros() - gpio_poll_started_us_;
+  if (elapsed < SEESAW_DELAY_US) {
+    delayMicroseconds(SEESAW_DELAY_US - elapsed);
+  }
+  finish_gpio_poll_();
+}
+
 bool SeesawDevice::set_gpio_input_pullup(uint32_t pin_mask) {
+  input_mask_ &= ~pin_mask;
+  pullup_mask_ |= pin_mask;
+  if (!write_gpio_input_pullup_(pin_mask)) {
+    config_dirty_ = true;
+    return false;
+  }
+  return true;
+}
+
+bool SeesawDevice::set_gpio_input(uint32_t pin_mask) {
+  pullup_mask_ &= ~pin_mask;
+  input_mask_ |= pin_mask;
+  if (!write_gpio_input_(pin_mask)) {
+    config_dirty_ = true;
+    return false;
+  }
+  return true;
+}
+
+bool SeesawDevice::write_gpio_input_pullup_(uint32_t pin_mask) {
   // First set direction to input
   uint8_t mask_buf[4] = {
     (uint8_t)(pin_mask >> 24),
@@ -187,7 +481,7 @@ bool SeesawDevice::set_gpio_input_pullup(uint32_t pin_mask) {
   return true;
 }
 
-bool SeesawDevice::set_gpio_input(uint32_t pin_mask) {
+bool SeesawDevice::write_gpio_input_(uint32_t pin_mask) {
   uint8_t mask_buf[4] = {
     (uint8_t)(pin_mask >> 24),
     (uint8_t)(pin_mask >> 16),
@@ -201,42 +495,95 @@ bool SeesawDevice::set_gpio_input(uint32_t pin_mask) {
 // NeoPixel helpers
 
 bool SeesawDevice::init_neopixel(uint8_t pin, uint16_t num_pixels, uint8_t bytes_per_pixel) {
+  neopixel_pin_ = pin;
+  neopixel_bpp_ = bytes_per_pixel;
+  neopixel_requested_len_ = (size_t) num_pixels * bytes_per_pixel;
+  if (!write_neopixel_config_()) {
+    config_dirty_ = true;
+    return false;
+  }
+
+  ESP_LOGD(TAG, "NeoPixel initialized: pin=%d, pixels=%d, bytes_per_pixel=%d",
+           pin, num_pixels, bytes_per_pixel);
+  return true;
+}
+
+uint16_t SeesawDevice::get_neopixel_buf_max_() const {
+  switch (hardware_id_) {
+    case SEESAW_HW_ID_CODE_SAMD09:
+      return SEESAW_NEOPIXEL_BUF_MAX_SAMD09;
+    case SEESAW_HW_ID_CODE_TINY1616:
+    case SEESAW_HW_ID_CODE_TINY1617:
+      return SEESAW_NEOPIXEL_BUF_MAX_TINY16XX;
+    case SEESAW_HW_ID_CODE_TINY806:
+    case SEESAW_HW_ID_CODE_TINY807:
+    case SEESAW_HW_ID_CODE_TINY816:
+    case SEESAW_HW_ID_CODE_TINY817:
+      return SEESAW_NEOPIXEL_BUF_MAX_TINY8XX;
+    default:
+      return 0;  // Chip not verified yet
+  }
+}
+
+size_t SeesawDevice::get_neopixel_max_chunk() const {
+  // Both limits include the module/register bytes; the chunk also carries a 2-byte offset
+  return std::min((size_t) SEESAW_I2C_RX_MAX - 2, SEESAW_MAX_WRITE_LEN) - 2;
+}
+
+bool SeesawDevice::write_neopixel_config_() {
+  // Capacity depends on the chip, which is only known once the hub has answered. Until then
+  // leave the config pending; apply_config_() sends it after the first successful probe.
+  if (hardware_id_ == 0) {
+    return false;
+  }
+
+  // Whole pixels only, so a clamped RGBW chain doesn't end on a partial pixel
+  uint16_t buf_max = get_neopixel_max_pixels(neopixel_bpp_) * neopixel_bpp_;
+  if (neopixel_requested_len_ > buf_max) {
+    ESP_LOGE(TAG, "NeoPixel buffer of %u bytes exceeds chip capacity of %u bytes, LEDs past it stay dark",
+             (unsigned) neopixel_requested_len_, buf_max);
+  }
+  neopixel_buf_len_ = std::min(neopixel_requested_len_, (size_t) buf_max);
+
   // Set NeoPixel output pin
-  if (!write_register(SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_PIN, &pin, 1)) {
-    ESP_LOGE(TAG, "Failed to set NeoPixel pin");
+  if (!write_register(SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_PIN, &neopixel_pin_, 1)) {
+    ESP_LOGV(TAG, "Failed to set NeoPixel pin");
     return false;
   }
 
   // Set speed to 800kHz
   uint8_t speed = SEESAW_NEOPIXEL_SPEED_800KHZ;
   if (!write_register(SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_SPEED, &speed, 1)) {
-    ESP_LOGE(TAG, "Failed to set NeoPixel speed");
+    ESP_LOGV(TAG, "Failed to set NeoPixel speed");
     return false;
   }
 
   // Set buffer length (big-endian 16-bit)
-  uint16_t buf_len = num_pixels * bytes_per_pixel;
-  uint8_t len_buf[2] = {(uint8_t)(buf_len >> 8), (uint8_t)(buf_len)};
+  uint8_t len_buf[2] = {(uint8_t)(neopixel_buf_len_ >> 8), (uint8_t)(neopixel_buf_len_)};
   if (!write_register(SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_BUF_LENGTH, len_buf, 2)) {
-    ESP_LOGE(TAG, "Failed to set NeoPixel buffer length");
+    ESP_LOGV(TAG, "Failed to set NeoPixel buffer length");
     return false;
   }
 
-  ESP_LOGD(TAG, "NeoPixel initialized: pin=%d, pixels=%d, bytes_per_pixel=%d",
-           pin, num_pixels, bytes_per_pixel);
   return true;
 }
 
 bool SeesawDevice::write_neopixel_buffer(uint16_t offset, const uint8_t *data, size_t len) {
-  // NeoPixel buffer write format: [offset_high, offset_low, data...]
-  // Max chunk size is limited by I2C buffer (typically 30 bytes of data)
-  std::vector<uint8_t> buffer;
-  buffer.reserve(2 + len);
-  buffer.push_back((uint8_t)(offset >> 8));
-  buffer.push_back((uint8_t)(offset));
-  buffer.insert(buffer.end(), data, data + len);
-
-  return write_register(SEESAW_NEOPIXEL_BASE, SEESAW_NEOPIXEL_BUF, buffer.data(), buffer.size());
+  // NeoPixel buffer write format: [module, reg, offset_high, offset_low, data...], built once
+  // Callers chunk to get_neopixel_max_chunk(); this only guards the stack buffer
+  if (len + 2 > SEESAW_MAX_WRITE_LEN) {
+    ESP_LOGE(TAG, "NeoPixel chunk too long: %u bytes", (unsigned) len);
+    return false;
+  }
+
+  uint8_t frame[2 + SEESAW_MAX_WRITE_LEN];
+  frame[0] = SEESAW_NEOPIXEL_BASE;
+  frame[1] = SEESAW_NEOPIXEL_BUF;
+  frame[2] = (uint8_t)(offset >> 8);
+  frame[3] = (uint8_t)(offset);
+  memcpy(frame + 4, data, len);
+
+  return write_frame_(frame, len + 4);
 }
 
 bool SeesawDevice::show_neopixels() {
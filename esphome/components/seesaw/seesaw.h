@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "esphome/components/i2c/i2c.h"
 #include <vector>
 
@@ -12,17 +13,30 @@ namespace seesaw {
 class SeesawGPIOBinarySensor;
 class SeesawNeoPixelLight;
 
+// Per-hub link health. A hub that stops responding is taken offline and probed with
+// exponential backoff instead of being marked failed, so it can come back on its own.
+enum SeesawHealth : uint8_t {
+  SEESAW_HEALTH_ONLINE = 0,    // Transactions succeeding
+  SEESAW_HEALTH_DEGRADED = 1,  // Recent failures, still polling normally
+  SEESAW_HEALTH_OFFLINE = 2,   // Not responding, all traffic suppressed until the next probe
+  SEESAW_HEALTH_PROBING = 3,   // Checking the hardware ID and re-applying config
+};
+
 class SeesawDevice : public PollingComponent, public i2c::I2CDevice {
  public:
   SeesawDevice() = default;
 
   void setup() override;
   void update() override;
+  void loop() override;
   void dump_config() override;
   float get_setup_priority() const override;
 
   // Child registration
-  void register_binary_sensor(SeesawGPIOBinarySensor *sensor) { binary_sensors_.push_back(sensor); }
+  void register_binary_sensor(SeesawGPIOBinarySensor *sensor) {
+    binary_sensors_.push_back(sensor);
+    gpio_state_valid_ = false;  // New sensor needs its first read
+  }
   void register_neopixel_light(SeesawNeoPixelLight *light) { neopixel_light_ = light; }
 
   // Core I2C methods (two-byte addressing with read delay)
@@ -39,19 +53,78 @@ class SeesawDevice : public PollingComponent, public i2c::I2CDevice {
   bool init_neopixel(uint8_t pin, uint16_t num_pixels, uint8_t bytes_per_pixel);
   bool write_neopixel_buffer(uint16_t offset, const uint8_t *data, size_t len);
   bool show_neopixels();
+  // Buffer length actually configured on the chip, clamped to its capacity in whole pixels
+  uint16_t get_neopixel_buf_len() const { return neopixel_buf_len_; }
+  // Most pixels the detected chip can drive, 0 until the hub has answered with a known ID
+  uint16_t get_neopixel_max_pixels(uint8_t bytes_per_pixel) const {
+    return get_neopixel_buf_max_() / bytes_per_pixel;
+  }
+  // Largest pixel data chunk for one write_neopixel_buffer() call on this chip and host
+  size_t get_neopixel_max_chunk() const;
 
   // Configuration
   void set_software_reset(bool reset) { software_reset_ = reset; }
 
+  // Set by the light when a frame didn't fully reach the chip, so update() re-sends it
+  void set_frame_dirty(bool dirty) { frame_dirty_ = dirty; }
+
+  SeesawHealth get_health() const { return health_; }
+  bool is_connected() const { return health_ == SEESAW_HEALTH_ONLINE || health_ == SEESAW_HEALTH_DEGRADED; }
+
  protected:
-  bool verify_hardware_id_();
-  void configure_gpio_pins_();
+  // Sends an already framed [module, reg, data...] write
+  bool write_frame_(const uint8_t *frame, size_t len);
+  static bool is_known_hardware_id_(uint8_t hw_id);
+  bool configure_gpio_pins_();
+  bool write_gpio_input_pullup_(uint32_t pin_mask);
+  bool write_gpio_input_(uint32_t pin_mask);
+  bool write_neopixel_config_();
+  // Capacity of the detected chip, 0 until the hub has answered with a known ID
+  uint16_t get_neopixel_buf_max_() const;
+  // Re-sends pin config, NeoPixel config and the last frame, e.g. after a reconnect
+  bool apply_config_();
+
+  void record_transaction_(bool ok);
+  // Rate limit for health transition logs
+  bool should_log_health_();
+  void go_offline_();
+  void probe_();
   void notify_binary_sensors_(uint32_t gpio_state);
+  // Split-phase GPIO poll: update() writes the read address, loop() fetches the data once the
+  // settle delay has passed, so the delay doesn't block the main loop
+  bool start_gpio_poll_();
+  bool is_gpio_poll_ready_() const;
+  void finish_gpio_poll_();
+  // Completes an outstanding GPIO poll before another transaction moves the register pointer
+  void flush_gpio_poll_();
 
   std::vector<SeesawGPIOBinarySensor *> binary_sensors_;
   SeesawNeoPixelLight *neopixel_light_{nullptr};
+  uint32_t last_gpio_state_{0};
+  bool gpio_state_valid_{false};
+  bool gpio_poll_pending_{false};
+  uint32_t gpio_poll_started_us_{0};
+  HighFrequencyLoopRequester high_freq_;
   bool software_reset_{true};
-  uint8_t hardware_id_{0};
+  uint8_t hardware_id_{0};  // Only set once verified as a known chip
+
+  // Desired config, kept so it can be re-applied when the hub comes back
+  uint32_t input_mask_{0};
+  uint32_t pullup_mask_{0};
+  uint8_t neopixel_pin_{0};
+  uint8_t neopixel_bpp_{3};
+  size_t neopixel_requested_len_{0};
+  uint16_t neopixel_buf_len_{0};
+  bool config_dirty_{false};
+  bool frame_dirty_{false};
+
+  SeesawHealth health_{SEESAW_HEALTH_PROBING};  // Until setup() has heard from the hub
+  uint8_t failure_count_{0};          // Failed transactions since the hub was last ONLINE
+  uint8_t consecutive_successes_{0};  // Counts towards leaving DEGRADED
+  uint32_t probe_interval_ms_{0};
+  uint32_t online_since_ms_{0};
+  uint32_t last_health_log_ms_{0};
+  bool health_logged_{false};
 };
 
 }  // namespace seesaw
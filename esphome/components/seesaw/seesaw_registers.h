@@ -3,6 +3,11 @@
 // Adafruit Seesaw Register Definitions
 // Reference: https://github.com/adafruit/Adafruit_Seesaw
 
+#include "esphome/core/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
 namespace esphome {
 namespace seesaw {
 
@@ -77,5 +82,25 @@ constexpr uint32_t NEOKEY_1X4_BUTTON_MASK = 0xF0;  // Pins 4-7
 // Seesaw I2C protocol timing
 constexpr uint16_t SEESAW_DELAY_US = 250;  // Delay between write and read
 
+// Largest I2C write the host platform's driver takes in one transaction
+#if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040)
+constexpr size_t SEESAW_HOST_I2C_BUFFER = 128;
+#else
+constexpr size_t SEESAW_HOST_I2C_BUFFER = 32;
+#endif
+
+// Largest payload (after the module/register address) sent in one write transaction
+constexpr size_t SEESAW_MAX_WRITE_LEN = SEESAW_HOST_I2C_BUFFER - 2;
+
+// Per-chip NeoPixel buffer capacity in bytes, limited by the chip's SRAM
+constexpr uint16_t SEESAW_NEOPIXEL_BUF_MAX_SAMD09 = 510;    // 170 RGB / 127 RGBW pixels
+constexpr uint16_t SEESAW_NEOPIXEL_BUF_MAX_TINY8XX = 180;   // 60 RGB / 45 RGBW pixels (512 B SRAM)
+constexpr uint16_t SEESAW_NEOPIXEL_BUF_MAX_TINY16XX = 750;  // 250 RGB / 187 RGBW pixels (2 KB SRAM)
+
+// Limit on one incoming I2C write, including the two module/register bytes. This is the
+// 30-byte NeoPixel chunk (plus its 2-byte offset) the component has always sent. A larger
+// SAMD09 receive buffer hasn't been checked on hardware, so every chip uses this limit.
+constexpr uint8_t SEESAW_I2C_RX_MAX = 34;
+
 }  // namespace seesaw
 }  // namespace esphome